@@ -0,0 +1,118 @@
+/*
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2022 Mikhail Remnev
+ * 
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ * 
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ * 
+ */
+
+// Counts heap allocations made on the call paths shown in example.cc
+// and fails (non-zero exit code) if any of them exceeds the expected limit.
+// The limits are upper bounds measured with libstdc++, they depend
+// on the size of its small string buffer (other libraries may differ).
+// Built and run twice by `make test`:
+//   g++ -std=c++98 example_alloc.cc                  (default build)
+//   g++ -std=c++11 -DFUNCTOR_CXX11 example_alloc.cc  (move semantics)
+
+#include <new>
+#include <cstdlib>
+#include "functor.h"
+
+static int alloc_count = 0;
+
+void* operator new(std::size_t size)
+{
+  alloc_count++;
+  void* p = malloc(size ? size : 1);
+  if (!p) throw std::bad_alloc();
+  return p;
+}
+void operator delete(void* p) throw() { free(p); }
+void operator delete(void* p, std::size_t) throw() { free(p); }
+
+FUNCTOR(greet, const char* who, const char* what)
+{
+  (void)who; (void)what;
+  return Typeless::None();
+}
+
+// Fills the vector outside of the measured region.
+// Arguments are kept longer than the small string buffer,
+// so that every std::string copy shows up as an allocation.
+static vec_str make_args()
+{
+  vec_str v;
+  v.push_back("a rather long first argument");
+  v.push_back("a rather long second argument");
+  return v;
+}
+
+// Prints the number of allocations and returns 1 if it exceeds the limit
+static int check(const char* what, int count, int limit)
+{
+  printf("  %-40s %d (limit %d)%s\n", what, count, limit,
+      count > limit ? " FAILED" : "");
+  return count > limit ? 1 : 0;
+}
+
+int main()
+{
+  vec_str v = make_args();
+  int before;
+  int failed = 0;
+
+#ifdef FUNCTOR_CXX11
+  const int g_limit = 2, call_limit = 2, move_limit = 0;
+  printf("Allocations per call (FUNCTOR_CXX11 build):\n");
+#else
+  const int g_limit = 5, call_limit = 5;
+  printf("Allocations per call (default build):\n");
+#endif
+
+  // 1. By explicitly specifying function name (no vector involved).
+  before = alloc_count;
+  greet(v[0].c_str(), v[1].c_str());
+  failed += check("greet(...)", alloc_count - before, 0);
+
+  // 2. By creating the instance of a functor.
+  Functor_greet g;
+  before = alloc_count;
+  g(v);
+  failed += check("Functor_greet()(v)", alloc_count - before, g_limit);
+
+  // 3. By searching for functor in a functor map.
+  Functor* h = func_map("greet");
+  before = alloc_count;
+  h->call(v);
+  failed += check("func_map(\"greet\")->call(v)", alloc_count - before, call_limit);
+
+#ifdef FUNCTOR_CXX11
+  // Arguments that are not needed afterwards are moved, not copied.
+  vec_str tmp = make_args();
+  before = alloc_count;
+  h->call(std::move(tmp));
+  failed += check("func_map(\"greet\")->call(std::move(tmp))", alloc_count - before, move_limit);
+#endif
+
+  return failed ? 1 : 0;
+}
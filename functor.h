@@ -38,6 +38,22 @@
 // See README.md for the detailed description.
 // See example.cc for usage example.
 
+// Define FUNCTOR_CXX11 before including this header to enable
+// move semantics (Typeless from std::string&&, rvalue overloads of call()).
+// Requires a C++11 compiler.
+// NOTE: With FUNCTOR_CXX11, Functor::operator() takes `const vec_str&`
+// and `vec_str&&` instead of `vec_str`. Hand-written subclasses have to
+// override `operator()(const vec_str&)` (an override of `operator()(vec_str)`
+// would never be called); overriding `operator()(vec_str&&)` is optional
+// and only needed to move the arguments (otherwise add
+// `using Functor::operator();` to avoid -Woverloaded-virtual warning).
+#ifdef FUNCTOR_CXX11
+#  if __cplusplus < 201103L
+#    error "FUNCTOR_CXX11 requires C++11 or newer (e.g. -std=c++11)"
+#  endif
+#  include <utility>
+#endif
+
 /**********************************************/
 /*               TYPELESS CLASS               */
 /**********************************************/
@@ -75,6 +91,15 @@ public:
     return *this;
   }
 
+#ifdef FUNCTOR_CXX11
+  Typeless(std::string&& val) : value(std::move(val)) {}
+  Typeless& operator=(std::string&& s)
+  {
+    value = std::move(s);
+    return *this;
+  }
+#endif
+
   operator const char*() {
     return value.c_str();
   }
@@ -136,21 +161,32 @@ public:
   Functor(const Functor& copy) : name(copy.name), args(copy.args), arg_count(copy.arg_count) {}
 
   // Returns function name
-  std::string getName() { return name; }
+  const std::string& getName() const { return name; }
   // Returns something like "int x, int y, float z"
-  std::string getArgs() { return args; }
+  const std::string& getArgs() const { return args; }
   // Return number of arguments required by this metafunction
-  int getArgCount() { return arg_count; }
+  int getArgCount() const { return arg_count; }
   // Call function
+#ifdef FUNCTOR_CXX11
+  // Arguments are only copied when they are passed as lvalue,
+  // rvalue overloads move them into the Typeless arguments.
+  virtual Typeless operator()(const vec_str& /*v*/) {return 0;}
+  virtual Typeless operator()(vec_str&& v) { return (*this)(v); }
+  Typeless call(const vec_str& v) { return (*this)(v); }
+  Typeless call(vec_str&& v) { return (*this)(std::move(v)); }
+#else
   virtual Typeless operator()(vec_str /*v*/) {return 0;}
-  Typeless call(vec_str v) { return (*this)(v); }
+  Typeless call(const vec_str& v) { return (*this)(v); }
+#endif
 
-  void checkArgs(vec_str& arg_vals)
+  // Throws if not enough arguments are passed
+  // (a single missing int argument is allowed,
+  //  since Typeless() already defaults to "0")
+  void checkArgs(const vec_str& arg_vals) const
   {
     int vec_size = arg_vals.size();
     if (vec_size < arg_count) {
       if (arg_count == 1 && args.substr(0, 3) == "int") {
-        arg_vals.push_back("0");
         return;
       }
 
@@ -163,8 +199,8 @@ public:
     }
   }
 
-  std::string getReturnType() { return ret_type; }
-  std::string setReturnType(std::string new_type) { return ret_type = new_type; }
+  const std::string& getReturnType() const { return ret_type; }
+  const std::string& setReturnType(const std::string& new_type) { return ret_type = new_type; }
 
 private:
   /** Function name */
@@ -184,7 +220,7 @@ inline std::map<std::string, Functor*>& func_map()
   return static_func_map;
 }
 /** Get specific functor by name */
-inline Functor* func_map(std::string name)
+inline Functor* func_map(const std::string& name)
 {
   return func_map()[name];
 }
@@ -222,20 +258,7 @@ inline Functor* func_map(std::string name)
   public: \
     Functor_ ## funcname() : Functor(#funcname, #__VA_ARGS__) {} \
     Functor_ ## funcname(const Functor& copy) : Functor(copy) {} \
-    virtual Typeless operator()(vec_str v) \
-    { \
-      checkArgs(v); \
-      Typeless args[20]; \
-      for (unsigned int i = 0; i < 20 && i < v.size(); i++) { \
-        args[i] = v[i]; \
-      } \
-      \
-      return funcname( \
-        args[ 0], args[ 1], args[ 2], args[ 3], args[ 4], args[ 5], \
-        args[ 6], args[ 7], args[ 8], args[ 9], args[10], args[11], \
-        args[12], args[13], args[14], args[15], args[16], args[17], \
-        args[18], args[19]); \
-    } \
+    __FUNCTOR_CALL_OPERATORS(funcname) \
   }; \
   Functor_ ## funcname * funcname ## _ptr = (Functor_ ## funcname *)(func_map()[#funcname] = new Functor_ ## funcname()); \
   Typeless funcname(__FUNCTOR_DISCARD_FIRST_ARG(, ##__VA_ARGS__, FUNCTOR_ARG_LIST_IMPL))
@@ -322,6 +345,49 @@ inline Functor* func_map(std::string name)
 /*             AUXILLARY MACRO                */
 /**********************************************/
 
+//== Body of operator() for the functor classes created by FUNCTOR macro.
+//   Converts vector of strings to Typeless arguments and calls funcname.
+//   With FUNCTOR_CXX11, rvalue vector is moved instead of copied.
+#ifdef FUNCTOR_CXX11
+#define __FUNCTOR_CALL_OPERATORS(funcname) \
+    virtual Typeless operator()(const vec_str& v) override \
+    { \
+      checkArgs(v); \
+      Typeless args[20]; \
+      for (unsigned int i = 0; i < 20 && i < v.size(); i++) { \
+        args[i] = v[i]; \
+      } \
+      return __FUNCTOR_CALL_WITH_ARGS(funcname, args); \
+    } \
+    virtual Typeless operator()(vec_str&& v) override \
+    { \
+      checkArgs(v); \
+      Typeless args[20]; \
+      for (unsigned int i = 0; i < 20 && i < v.size(); i++) { \
+        args[i] = std::move(v[i]); \
+      } \
+      return __FUNCTOR_CALL_WITH_ARGS(funcname, args); \
+    }
+#else
+#define __FUNCTOR_CALL_OPERATORS(funcname) \
+    virtual Typeless operator()(vec_str v) \
+    { \
+      checkArgs(v); \
+      Typeless args[20]; \
+      for (unsigned int i = 0; i < 20 && i < v.size(); i++) { \
+        args[i] = v[i]; \
+      } \
+      return __FUNCTOR_CALL_WITH_ARGS(funcname, args); \
+    }
+#endif
+//== Call funcname with all 20 elements of the Typeless array args
+#define __FUNCTOR_CALL_WITH_ARGS(funcname, args) \
+      funcname( \
+        args[ 0], args[ 1], args[ 2], args[ 3], args[ 4], args[ 5], \
+        args[ 6], args[ 7], args[ 8], args[ 9], args[10], args[11], \
+        args[12], args[13], args[14], args[15], args[16], args[17], \
+        args[18], args[19])
+
 //== Helper macro to repeat (x) 20 times
 #define __FUNCTOR_REPEAT_20(x) \
   x,x,x,x,x,x,x,x,x,x,x,x,x,x,x,x,x,x,x,x